@@ -0,0 +1,22 @@
+// rlobj (c) Nikolas Wipper 2021
+
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0, with exemptions for Ramon Santamaria and the
+ * raylib contributors who may, at their discretion, instead license
+ * any of the Covered Software under the zlib license. If a copy of
+ * the MPL was not distributed with this file, You can obtain one
+ * at https://mozilla.org/MPL/2.0/. */
+
+#include "rlobj.h"
+#include "stdio.h"
+
+// Packs OBJ files, their MTL files and textures into one archive for LoadObjArchive
+// Models are loaded by the path given here, e.g. LoadObjFromArchive(archive, "models/castle.obj", 0)
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printf("usage: %s <archive> <model.obj>...\n", argv[0]);
+        return 1;
+    }
+
+    return ExportObjArchive(argv[1], (const char **) argv + 2, argc - 2) ? 0 : 1;
+}
@@ -7,14 +7,52 @@
  * the MPL was not distributed with this file, You can obtain one
  * at https://mozilla.org/MPL/2.0/. */
 
+// The benchmark internals are always built, test.c only needs to define this to see them
+#ifndef RLOBJ_BENCHMARK
+#define RLOBJ_BENCHMARK
+#endif
 #include "rlobj.h"
 
 #include <rlgl.h>
+#include <raymath.h>
 #include <math.h>
+#include <float.h>
+#include <limits.h>
 #include <ctype.h>
+#include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 
+// Worker threads are used for CPU bound loading stages. Without pthreads, everything runs on the calling thread.
+// This includes MinGW: its unistd.h has no sysconf to count processors, and windows.h clashes with raylib.h.
+#if !defined(RLOBJ_NO_THREADS) && defined(_WIN32)
+#define RLOBJ_NO_THREADS
+#endif
+
+#ifndef RLOBJ_NO_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// Attribute expansion uses AVX2 gathers if the compiler targets it
+#if defined(__AVX2__) && !defined(RLOBJ_NO_SIMD)
+#define RLOBJ_AVX2
+#include <immintrin.h>
+#endif
+
+// Archives are mapped into memory where possible, otherwise they are read completely
+#if !defined(RLOBJ_NO_MMAP) && defined(_WIN32)
+#define RLOBJ_NO_MMAP
+#endif
+
+#ifndef RLOBJ_NO_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 typedef struct Edge { int vertex; int texcoord; int normal; } Edge;
 typedef struct Face { Edge edges[3]; } Face;
 
@@ -41,6 +79,15 @@ typedef struct GenericFile {
     char *data;
 } GenericFile;
 
+// Syntax of the edges in an f statement
+typedef enum FaceFormat {
+    FACE_FORMAT_UNKNOWN = 0,
+    FACE_FORMAT_V,          // v
+    FACE_FORMAT_V_VT,       // v/vt
+    FACE_FORMAT_V_VN,       // v//vn
+    FACE_FORMAT_V_VT_VN,    // v/vt/vn
+} FaceFormat;
+
 typedef struct OBJFile {
     char *base;
 
@@ -53,7 +100,11 @@ typedef struct OBJFile {
     int texcoord_count;
     int normal_count;
     int face_count;
+    int face_capacity;
 
+    // Format of the last face, used to pick a specialized reader for the next one
+    FaceFormat face_format;
+    bool general_faces; // Always use the general reader instead
     bool triangulation_warning;
 
     OBJMat *mats;
@@ -89,6 +140,79 @@ char *AddBase(char *path, const char *base) {
     return path;
 }
 
+// Parallel helpers
+
+// Processes [begin, end) of a job
+typedef void (*RangeJob)(void *ctx, int begin, int end);
+
+typedef struct ParallelRange {
+    RangeJob job;
+    void *ctx;
+    int count, grain;
+    int next;
+#ifndef RLOBJ_NO_THREADS
+    pthread_mutex_t lock;
+#endif
+} ParallelRange;
+
+int GetWorkerCount(void) {
+#ifndef RLOBJ_NO_THREADS
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n > 1) return n > 64 ? 64 : (int) n;
+#endif
+    return 1;
+}
+
+#ifndef RLOBJ_NO_THREADS
+void *ParallelRangeWorker(void *arg) {
+    ParallelRange *range = (ParallelRange *) arg;
+
+    while (true) {
+        pthread_mutex_lock(&range->lock);
+        int begin = range->next;
+        range->next += range->grain;
+        pthread_mutex_unlock(&range->lock);
+
+        if (begin >= range->count) break;
+        int end = begin + range->grain < range->count ? begin + range->grain : range->count;
+        range->job(range->ctx, begin, end);
+    }
+    return NULL;
+}
+#endif
+
+// Splits [0, count) into chunks of grain items and runs job on them from multiple threads
+// Returns once all chunks are done, the calling thread works on chunks as well
+void ParallelFor(int count, int grain, RangeJob job, void *ctx) {
+    if (count <= 0) return;
+    if (grain < 1) grain = 1;
+
+    int chunks = (count + grain - 1) / grain;
+    int workers = GetWorkerCount();
+    if (workers > chunks) workers = chunks;
+
+#ifndef RLOBJ_NO_THREADS
+    if (workers > 1) {
+        ParallelRange range = {.job = job, .ctx = ctx, .count = count, .grain = grain, .next = 0};
+        pthread_mutex_init(&range.lock, NULL);
+
+        pthread_t *threads = (pthread_t *) RL_CALLOC(workers - 1, sizeof(pthread_t));
+        int started = 0;
+        for (; started < workers - 1; started++) {
+            if (pthread_create(&threads[started], NULL, ParallelRangeWorker, &range) != 0) break;
+        }
+        ParallelRangeWorker(&range);
+        for (int i = 0; i < started; i++) pthread_join(threads[i], NULL);
+
+        RL_FREE(threads);
+        pthread_mutex_destroy(&range.lock);
+        return;
+    }
+#endif
+
+    job(ctx, 0, count);
+}
+
 // Generic reader functions
 
 void IgnoreLine(GenericFile *file) {
@@ -383,7 +507,23 @@ ValidEdge ReadEdge(GenericFile *file) {
     return (ValidEdge) {e, true};
 }
 
-void ReadFace(OBJFile *file) {
+void PushFace(OBJFile *file, Face f) {
+    if (file->face_count == file->face_capacity) {
+        file->face_capacity = file->face_capacity ? file->face_capacity * 2 : 64;
+        file->faces = (Face *) RL_REALLOC(file->faces, sizeof(Face) * file->face_capacity);
+    }
+    file->faces[file->face_count++] = f;
+}
+
+void WarnTriangulation(OBJFile *file) {
+    if (!file->triangulation_warning) {
+        TraceLog(LOG_WARNING, "MESH: Triangulation is only very basic. Try doing that in your modeling software.");
+        file->triangulation_warning = true;
+    }
+}
+
+// General face reader, accepts every edge format and mixing them
+void ReadFaceGeneral(OBJFile *file) {
     Face f;
 
     for (int i = 0; i < 3; i++) {
@@ -393,31 +533,252 @@ void ReadFace(OBJFile *file) {
         else return;
     }
 
-    file->faces = (Face *) RL_REALLOC(file->faces, sizeof(Face) * ++file->face_count);
-    int fc = file->face_count - 1;
-    file->faces[fc] = f;
+    PushFace(file, f);
 
     ClearWhitespace(&file->data);
 
     // Naïve triangulation
     while (isdigit(*file->data.data)) {
-        if (!file->triangulation_warning) {
-            TraceLog(LOG_WARNING, "MESH: Triangulation is only very basic. Try doing that in your modeling software.");
-            file->triangulation_warning = true;
-        }
-        file->faces = (Face *) RL_REALLOC(file->faces, sizeof(Face) * ++file->face_count);
+        WarnTriangulation(file);
         f.edges[1] = f.edges[2];
 
         ValidEdge vE = ReadEdge(&file->data);
         if (vE.valid) {
             f.edges[2] = vE.e;
-            f.edges[2] = vE.e;
-            file->faces[++fc] = f;
+            PushFace(file, f);
         } else return;
         ClearWhitespace(&file->data);
     }
 }
 
+FaceFormat DetectFaceFormat(const char *data) {
+    while (*data == ' ' || *data == '\t') data++;
+    if (!isdigit(*data)) return FACE_FORMAT_UNKNOWN;
+    while (isdigit(*data)) data++;
+
+    if (*data != '/') return FACE_FORMAT_V;
+    data++;
+    if (*data == '/') return FACE_FORMAT_V_VN;
+    while (isdigit(*data)) data++;
+    return *data == '/' ? FACE_FORMAT_V_VT_VN : FACE_FORMAT_V_VT;
+}
+
+// Faces with more than this many edges are left to the general reader
+#define MAX_FAST_EDGES 32
+
+#define IS_DIGIT(c) ((unsigned char) ((c) - '0') <= 9)
+#define READ_DIGITS(p, out) for (; IS_DIGIT(*(p)); (p)++) (out) = (out) * 10 + (*(p) - '0')
+
+// Generates a face reader for one edge format
+// Instead of checking every edge for every format, these only accept exactly their format with unsigned decimal
+// indices, without signs or anything else on the line. They return false without consuming anything if the line doesn't match, so the
+// general reader can take over. The edges they produce are the same the general reader would produce.
+#define DEFINE_READ_FACE_FAST(NAME, HAS_VT, HAS_VN)                                         \
+bool NAME(OBJFile *file) {                                                                  \
+    const char *p = file->data.data;                                                        \
+    Edge edges[MAX_FAST_EDGES];                                                             \
+    int count = 0;                                                                          \
+                                                                                            \
+    while (true) {                                                                          \
+        while (*p == ' ' || *p == '\t') p++;                                                \
+        if (!IS_DIGIT(*p)) break;                                                           \
+        if (count == MAX_FAST_EDGES) return false;                                          \
+                                                                                            \
+        Edge e = {0};                                                                       \
+        READ_DIGITS(p, e.vertex);                                                           \
+        if (HAS_VT || HAS_VN) {                                                             \
+            if (*p++ != '/') return false;                                                  \
+        }                                                                                   \
+        if (HAS_VT) {                                                                       \
+            if (!IS_DIGIT(*p)) return false;                                                \
+            READ_DIGITS(p, e.texcoord);                                                     \
+        }                                                                                   \
+        if (HAS_VN) {                                                                       \
+            if (*p++ != '/' || !IS_DIGIT(*p)) return false;                                 \
+            READ_DIGITS(p, e.normal);                                                       \
+            if (e.texcoord == 0) e.texcoord = 1;                                            \
+        } else if (HAS_VT) {                                                                \
+            /* The general reader reads a single index after the slash as the normal */     \
+            if (e.texcoord == 0) return false;                                              \
+            e.normal = e.texcoord;                                                          \
+            e.texcoord = 1;                                                                 \
+        }                                                                                   \
+        edges[count++] = e;                                                                 \
+    }                                                                                       \
+                                                                                            \
+    if (count < 3 || (*p != '\n' && *p != '\r' && *p != '\0')) return false;                \
+                                                                                            \
+    Face f = {.edges = {edges[0], edges[1], edges[2]}};                                     \
+    PushFace(file, f);                                                                      \
+    if (count > 3) WarnTriangulation(file);                                                 \
+    for (int i = 3; i < count; i++) {                                                       \
+        f.edges[1] = f.edges[2];                                                            \
+        f.edges[2] = edges[i];                                                              \
+        PushFace(file, f);                                                                  \
+    }                                                                                       \
+                                                                                            \
+    file->data.data = (char *) p;                                                           \
+    return true;                                                                            \
+}
+
+DEFINE_READ_FACE_FAST(ReadFaceV, false, false)
+DEFINE_READ_FACE_FAST(ReadFaceVVt, true, false)
+DEFINE_READ_FACE_FAST(ReadFaceVVn, false, true)
+DEFINE_READ_FACE_FAST(ReadFaceVVtVn, true, true)
+
+// Files almost always use one edge format throughout, so the format of the last face picks the reader for this one
+// If it doesn't match, the general reader is used and the format is detected again
+void ReadFace(OBJFile *file) {
+    if (file->general_faces) {
+        ReadFaceGeneral(file);
+        return;
+    }
+
+    bool read = false;
+
+    switch (file->face_format) {
+        case FACE_FORMAT_V: read = ReadFaceV(file); break;
+        case FACE_FORMAT_V_VT: read = ReadFaceVVt(file); break;
+        case FACE_FORMAT_V_VN: read = ReadFaceVVn(file); break;
+        case FACE_FORMAT_V_VT_VN: read = ReadFaceVVtVn(file); break;
+        default: break;
+    }
+
+    if (!read) {
+        file->face_format = DetectFaceFormat(file->data.data);
+        ReadFaceGeneral(file);
+    }
+}
+
+// Faces per chunk when expanding attributes on multiple threads
+#define EXPAND_GRAIN 16384
+
+typedef struct ExpandJob {
+    const Edge *edges;              // Three per face
+    const Vector3 *vertices, *normals;
+    const Vector2 *texcoords;
+    int vertex_count, texcoord_count, normal_count;
+
+    Mesh mesh;
+    int *invalid;                   // Out of range vertex indices, per chunk
+} ExpandJob;
+
+// Writes the attributes of one edge into the mesh
+// Out of range indices read as zero, missing texcoords and normals are common so only vertices are reported
+// Returns false if the vertex index is out of range
+bool ExpandEdge(ExpandJob *job, int e) {
+    Edge edge = job->edges[e];
+    // Casting makes negative indices huge, so one comparison covers both ends
+    unsigned int vIn = (unsigned int) (edge.vertex - 1);
+    unsigned int tIn = (unsigned int) (edge.texcoord - 1);
+    unsigned int nIn = (unsigned int) (edge.normal - 1);
+
+    Vector3 v = vIn < (unsigned int) job->vertex_count ? job->vertices[vIn] : (Vector3) {0};
+    Vector2 t = tIn < (unsigned int) job->texcoord_count ? job->texcoords[tIn] : (Vector2) {0};
+    Vector3 n = nIn < (unsigned int) job->normal_count ? job->normals[nIn] : (Vector3) {0};
+
+    // Three floats per vertex and normal, two per texcoord
+    job->mesh.vertices[e * 3] = v.x;
+    job->mesh.vertices[e * 3 + 1] = v.y;
+    job->mesh.vertices[e * 3 + 2] = v.z;
+
+    job->mesh.texcoords[e * 2] = t.x;
+    job->mesh.texcoords[e * 2 + 1] = 1.f - t.y; // raylib flips textures upside down
+
+    job->mesh.normals[e * 3] = n.x;
+    job->mesh.normals[e * 3 + 1] = n.y;
+    job->mesh.normals[e * 3 + 2] = n.z;
+
+    return vIn < (unsigned int) job->vertex_count;
+}
+
+#ifdef RLOBJ_AVX2
+// Indices of edges [e, e + 8) minus one, component is 0 for vertex, 1 for texcoord and 2 for normal
+__m256i LoadEdgeIndices(const Edge *edges, int e, int component) {
+    const __m256i stride = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+    __m256i indices = _mm256_i32gather_epi32((const int *) (edges + e) + component, stride, 4);
+    return _mm256_sub_epi32(indices, _mm256_set1_epi32(1));
+}
+
+// All bits set in lanes with 0 <= index < count
+__m256i ValidIndices(__m256i indices, int count) {
+    __m256i below = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), indices);
+    __m256i above = _mm256_cmpgt_epi32(indices, _mm256_set1_epi32(-1));
+    return _mm256_and_si256(below, above);
+}
+
+// Gathers 8 edges of a three component attribute into 24 consecutive floats
+// Lane l of output block q holds component (q * 8 + l) % 3 of edge (q * 8 + l) / 3
+void GatherVector3(float *out, const Vector3 *source, __m256i indices, __m256i valid) {
+    const __m256i edge_of[3] = {
+        _mm256_setr_epi32(0, 0, 0, 1, 1, 1, 2, 2),
+        _mm256_setr_epi32(2, 3, 3, 3, 4, 4, 4, 5),
+        _mm256_setr_epi32(5, 5, 6, 6, 6, 7, 7, 7),
+    };
+    const __m256i component_of[3] = {
+        _mm256_setr_epi32(0, 1, 2, 0, 1, 2, 0, 1),
+        _mm256_setr_epi32(2, 0, 1, 2, 0, 1, 2, 0),
+        _mm256_setr_epi32(1, 2, 0, 1, 2, 0, 1, 2),
+    };
+
+    __m256i base = _mm256_mullo_epi32(indices, _mm256_set1_epi32(3));
+    for (int q = 0; q < 3; q++) {
+        __m256i offsets = _mm256_add_epi32(_mm256_permutevar8x32_epi32(base, edge_of[q]), component_of[q]);
+        __m256 mask = _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(valid, edge_of[q]));
+        // Masked lanes aren't read and stay zero
+        __m256 values = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), (const float *) source, offsets, mask, 4);
+        _mm256_storeu_ps(out + q * 8, values);
+    }
+}
+
+// Gathers 8 texcoords into 16 consecutive floats and flips V
+void GatherTexcoords(float *out, const Vector2 *source, __m256i indices, __m256i valid) {
+    const __m256i edge_of[2] = {
+        _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3),
+        _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7),
+    };
+    const __m256i component = _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1);
+
+    __m256i base = _mm256_add_epi32(indices, indices);
+    for (int q = 0; q < 2; q++) {
+        __m256i offsets = _mm256_add_epi32(_mm256_permutevar8x32_epi32(base, edge_of[q]), component);
+        __m256 mask = _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(valid, edge_of[q]));
+        __m256 values = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), (const float *) source, offsets, mask, 4);
+        // raylib flips textures upside down, only v becomes 1 - v so u stays bitwise the same as in ExpandEdge
+        __m256 flipped = _mm256_sub_ps(_mm256_set1_ps(1.f), values);
+        _mm256_storeu_ps(out + q * 8, _mm256_blend_ps(values, flipped, 0xAA));
+    }
+}
+#endif
+
+// Resolves the indices of faces [begin, end) into the mesh's attribute arrays
+void ExpandFaces(void *ctx, int begin, int end) {
+    ExpandJob *job = (ExpandJob *) ctx;
+    int e = begin * 3, last = end * 3;
+    int invalid = 0;
+
+#ifdef RLOBJ_AVX2
+    for (; e + 8 <= last; e += 8) {
+        __m256i vIn = LoadEdgeIndices(job->edges, e, 0);
+        __m256i tIn = LoadEdgeIndices(job->edges, e, 1);
+        __m256i nIn = LoadEdgeIndices(job->edges, e, 2);
+
+        __m256i valid = ValidIndices(vIn, job->vertex_count);
+        GatherVector3(job->mesh.vertices + e * 3, job->vertices, vIn, valid);
+        GatherTexcoords(job->mesh.texcoords + e * 2, job->texcoords, tIn, ValidIndices(tIn, job->texcoord_count));
+        GatherVector3(job->mesh.normals + e * 3, job->normals, nIn, ValidIndices(nIn, job->normal_count));
+
+        for (int bad = ~_mm256_movemask_ps(_mm256_castsi256_ps(valid)) & 0xFF; bad; bad &= bad - 1) invalid++;
+    }
+#endif
+
+    for (; e < last; e++) {
+        if (!ExpandEdge(job, e)) invalid++;
+    }
+
+    job->invalid[begin / EXPAND_GRAIN] = invalid;
+}
+
 OBJMesh LoadObjMesh(OBJFile *file) {
     unsigned long mat_hash;
     bool seen_o = false;
@@ -455,42 +816,27 @@ OBJMesh LoadObjMesh(OBJFile *file) {
 
     Mesh m = (Mesh) {0};
     if (file->vertex_count != 0) {
-        if (!file->texcoord_count || !file->texcoords) {
-            file->texcoords = (Vector2 *) RL_CALLOC(file->vertex_count, sizeof(Vector2)); // all texcoords will be 0,0
-        }
-        if (!file->normal_count || !file->normals) {
-            file->normals = (Vector3 *) RL_CALLOC(file->vertex_count, sizeof(Vector3)); // all normals will be 0,0,0
-        }
-
         m.vertexCount = file->face_count * 3;
         m.triangleCount = (int) file->face_count;
 
-        m.vertices = (float *) RL_CALLOC(m.vertexCount * 3, sizeof(float));
-        m.texcoords = (float *) RL_CALLOC(m.vertexCount * 2, sizeof(float));
-        m.normals = (float *) RL_CALLOC(m.vertexCount * 3, sizeof(float));
-
-        // Sort vertices, texcoords and normals
-        for (int i = 0; i < file->face_count; i++) {
-            for (int j = 0; j < 3; j++) {
-                int vIn = file->faces[i].edges[j].vertex - 1;
-                int tIn = file->faces[i].edges[j].texcoord - 1;
-                int nIn = file->faces[i].edges[j].normal - 1;
-
-                // Three vertices per face, three floats per vertex
-                m.vertices[i * 9 + j * 3] = file->vertices[vIn].x;
-                m.vertices[i * 9 + j * 3 + 1] = file->vertices[vIn].y;
-                m.vertices[i * 9 + j * 3 + 2] = file->vertices[vIn].z;
-
-                // Three coords per face, two floats per coords
-                m.texcoords[i * 6 + j * 2] = file->texcoords[tIn].x;
-                m.texcoords[i * 6 + j * 2 + 1] = 1.f - file->texcoords[tIn].y; // raylib flips textures upside down
-
-                // Three normals per face, three floats per normal
-                m.normals[i * 9 + j * 3] = file->normals[nIn].x;
-                m.normals[i * 9 + j * 3 + 1] = file->normals[nIn].y;
-                m.normals[i * 9 + j * 3 + 2] = file->normals[nIn].z;
-            }
-        }
+        // Every value gets written by ExpandFaces, so there is no need to clear them
+        m.vertices = (float *) RL_MALLOC(sizeof(float) * m.vertexCount * 3);
+        m.texcoords = (float *) RL_MALLOC(sizeof(float) * m.vertexCount * 2);
+        m.normals = (float *) RL_MALLOC(sizeof(float) * m.vertexCount * 3);
+
+        ExpandJob job = {
+            .edges = (const Edge *) file->faces,
+            .vertices = file->vertices, .texcoords = file->texcoords, .normals = file->normals,
+            .vertex_count = file->vertex_count, .texcoord_count = file->texcoord_count, .normal_count = file->normal_count,
+            .mesh = m,
+            .invalid = RL_CALLOC((file->face_count + EXPAND_GRAIN - 1) / EXPAND_GRAIN + 1, sizeof(int))
+        };
+        ParallelFor(file->face_count, EXPAND_GRAIN, ExpandFaces, &job);
+
+        int invalid = 0;
+        for (int i = 0; i < (file->face_count + EXPAND_GRAIN - 1) / EXPAND_GRAIN; i++) invalid += job.invalid[i];
+        if (invalid) TraceLog(LOG_WARNING, "MESH: %i vertex indices are out of range, using 0,0,0 instead", invalid);
+        RL_FREE(job.invalid);
     }
     return (OBJMesh) {.mesh = m, .mat_hash = mat_hash};
 }
@@ -501,31 +847,128 @@ Color Vector3ToColor(Vector3 vec, float opacity) {
     };
 }
 
-Texture LoadTextureBase(char *filename, char *base) {
-    Texture res;
-    if (base) filename = AddBase(filename, base);
-    res = LoadTexture(filename);
-    RL_FREE(filename);
-    return res;
+// Material maps raylib can use, in the order TakeMatMaps returns them
+#define OBJ_MAP_COUNT 4
+const int objMapSlots[OBJ_MAP_COUNT] = {MATERIAL_MAP_ALBEDO, MATERIAL_MAP_METALNESS, MATERIAL_MAP_ROUGHNESS, MATERIAL_MAP_NORMAL};
+
+// Takes the paths of the maps raylib can use out of mat, with their base added
+// Everything else mat owns is freed
+void TakeMatMaps(OBJMat mat, char *maps[OBJ_MAP_COUNT]) {
+    maps[0] = mat.diffuse_map;
+    // NOTE: I'm not totally sure which one is right, but for raylib specular is the same as "metalness" so that's what
+    //  we are using if both are defined
+    if (mat.specular_map) {
+        RL_FREE(mat.reflection_map);
+        maps[1] = mat.specular_map;
+    } else
+        maps[1] = mat.reflection_map;
+    maps[2] = mat.highlight_map;
+    maps[3] = mat.bump_map;
+
+    for (int i = 0; i < OBJ_MAP_COUNT; i++) {
+        if (maps[i] && mat.base) maps[i] = AddBase(maps[i], mat.base);
+    }
+
+    RL_FREE(mat.alpha_map);
+    RL_FREE(mat.ambient_map);
+    RL_FREE(mat.decal_map);
+    RL_FREE(mat.displacement_map);
+    RL_FREE(mat.base);
+}
+
+typedef struct TextureJob {
+    char *filename;
+    const unsigned char *file_data; // If set, the image is decoded from here instead of reading filename
+    int data_size;
+    int material, map;
+    Image image;
+} TextureJob;
+
+typedef struct TextureBatch {
+    TextureJob *jobs;
+    int count;
+    bool mipmaps;
+    bool parallel;                  // Whether raylib's image loaders may be called from worker threads
+} TextureBatch;
+
+// Queues a map for decoding, takes ownership of filename
+void AddTextureJob(TextureBatch *batch, char *filename, const unsigned char *file_data, int data_size, int material, int map) {
+    if (!filename) return;
+
+    batch->jobs = (TextureJob *) RL_REALLOC(batch->jobs, sizeof(TextureJob) * ++batch->count);
+    batch->jobs[batch->count - 1] = (TextureJob) {
+        .filename = filename, .file_data = file_data, .data_size = data_size, .material = material, .map = map, .image = {0}
+    };
+}
+
+// Decodes images on worker threads, nothing in here may touch the GL context
+void DecodeTextureJobs(void *ctx, int begin, int end) {
+    TextureBatch *batch = (TextureBatch *) ctx;
+
+    for (int i = begin; i < end; i++) {
+        TextureJob *job = &batch->jobs[i];
+        if (job->file_data)
+            job->image = LoadImageFromMemory(GetFileExtension(job->filename), job->file_data, job->data_size);
+        else
+            job->image = LoadImage(job->filename);
+        if (job->image.data && batch->mipmaps) ImageMipmaps(&job->image);
+    }
+}
+
+// Decodes the images of a batch and uploads them into materials, in parallel if the batch allows it
+// Only one image per worker is decoded at a time, so at most that many images are held in RAM at once
+void LoadTextureJobs(TextureBatch *batch, Material *materials) {
+    int step = batch->parallel ? GetWorkerCount() : 1;
+
+    for (int start = 0; start < batch->count; start += step) {
+        TextureBatch part = {.jobs = batch->jobs + start, .count = batch->count - start, .mipmaps = batch->mipmaps};
+        if (part.count > step) part.count = step;
+
+        ParallelFor(part.count, 1, DecodeTextureJobs, &part);
+
+        // Uploading has to happen on the thread that owns the GL context
+        // Maps that failed to decode keep their default texture
+        for (int i = 0; i < part.count; i++) {
+            TextureJob job = part.jobs[i];
+            if (job.image.data) {
+                materials[job.material].maps[job.map].texture = LoadTextureFromImage(job.image);
+                UnloadImage(job.image);
+            }
+            RL_FREE(job.filename);
+        }
+    }
+
+    RL_FREE(batch->jobs);
+    batch->jobs = NULL;
+    batch->count = 0;
 }
 
+typedef struct ParsedObj {
+    OBJMesh *meshes;
+    int mesh_count;
+    OBJMat *mats;
+    int mat_count;
+    bool valid;
+} ParsedObj;
+
 // Wrapper around read LoadObjMesh and LoadMtlMat
-// Loads model without uploading meshes
-Model LoadObjDry(const char *filename) {
-    char *data = LoadFileText(filename);
-    if (!data) return (Model) {0};
+// Only reads files, so this works without a window
+ParsedObj ParseObj(const char *filename, unsigned int flags) {
+    ParsedObj res = {0};
 
-    OBJMesh *meshes = NULL;
-    int mesh_count = 0;
+    char *data = LoadFileText(filename);
+    if (!data) return res;
 
     OBJFile file = (OBJFile) {0};
     file.data.data = data;
+    file.general_faces = (flags & OBJ_LOAD_GENERAL_FACES) != 0;
     file.base = PutStringOnHeap(GetPrevDirectoryPath(filename));
 
     while (*file.data.data) {
-        meshes = (OBJMesh *) RL_REALLOC(meshes, sizeof(OBJMesh) * ++mesh_count);
-        meshes[mesh_count - 1] = LoadObjMesh(&file);
+        res.meshes = (OBJMesh *) RL_REALLOC(res.meshes, sizeof(OBJMesh) * ++res.mesh_count);
+        res.meshes[res.mesh_count - 1] = LoadObjMesh(&file);
         file.face_count = 0;
+        file.face_capacity = 0;
         RL_FREE(file.faces);
         file.faces = NULL;
     }
@@ -534,87 +977,880 @@ Model LoadObjDry(const char *filename) {
     RL_FREE(file.vertices);
     RL_FREE(file.texcoords);
     RL_FREE(file.normals);
+    RL_FREE(file.base);
+
+    res.mats = file.mats;
+    res.mat_count = file.mat_count;
+    res.valid = true;
+    return res;
+}
+
+// Index of the material a mesh uses, the first one if it isn't found
+int FindObjMat(ParsedObj obj, OBJMesh mesh) {
+    int res = 0;
+    for (int i = 0; i < obj.mat_count; i++) {
+        if (obj.mats[i].name_hash == mesh.mat_hash)
+            res = i;
+    }
+    return res;
+}
+
+// Wrapper around ParseObj
+// Loads model without uploading meshes
+Model LoadObjDry(const char *filename, unsigned int flags) {
+    ParsedObj obj = ParseObj(filename, flags);
+    if (!obj.valid) return (Model) {0};
 
     Model model = {0};
 
     model.transform = (Matrix) {
         1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f
     };
-    model.meshes = (Mesh *) RL_CALLOC(mesh_count, sizeof(Mesh));
-    model.meshCount = mesh_count;
-    model.materialCount = file.mat_count;
-    model.materials = RL_CALLOC(file.mat_count, sizeof(Material));
-    model.meshMaterial = RL_CALLOC(mesh_count, sizeof(int));
+    model.meshes = (Mesh *) RL_CALLOC(obj.mesh_count, sizeof(Mesh));
+    model.meshCount = obj.mesh_count;
+    model.materialCount = obj.mat_count;
+    model.materials = RL_CALLOC(obj.mat_count, sizeof(Material));
+    model.meshMaterial = RL_CALLOC(obj.mesh_count, sizeof(int));
+
+    TextureBatch textures = {
+        .jobs = NULL, .count = 0, .mipmaps = (flags & OBJ_LOAD_GEN_MIPMAPS) != 0,
+        .parallel = (flags & OBJ_LOAD_PARALLEL_IMAGES) != 0
+    };
 
-    for (int i = 0; i < file.mat_count; i++) {
+    for (int i = 0; i < obj.mat_count; i++) {
         Material m = LoadMaterialDefault();
-        OBJMat names = file.mats[i];
+        OBJMat names = obj.mats[i];
 
         m.maps[MATERIAL_MAP_ALBEDO].color = Vector3ToColor(names.diffuse, names.opacity);
         m.maps[MATERIAL_MAP_METALNESS].color = Vector3ToColor(names.specular, names.opacity);
 
-        // if-check here, to prevent replacing default textures
+        // Maps are only queued here, so that all images of all materials can be decoded in parallel
+        // AddTextureJob ignores undefined maps, to prevent replacing default textures
         // These are used to display .color values even if no image is present
-        if (names.diffuse_map) m.maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureBase(names.diffuse_map, names.base);
-        else
-            RL_FREE(names.diffuse_map);
-        // NOTE: I'm not totally sure which one is right, but for raylib specular is the same as "metalness" so that's what
-        //  we are using if both are defined
-        if (names.reflection_map) m.maps[MATERIAL_MAP_METALNESS].texture = LoadTextureBase(names.reflection_map, names.base);
-        else
-            RL_FREE(names.reflection_map);
-        if (names.specular_map) {
-            if (rlGetTextureIdDefault() != m.maps[MATERIAL_MAP_METALNESS].texture.id)
-                UnloadTexture(m.maps[MATERIAL_MAP_METALNESS].texture);
-            m.maps[MATERIAL_MAP_METALNESS].texture = LoadTextureBase(names.specular_map, names.base);
-        } else
-            RL_FREE(names.specular_map);
-
-        if (names.highlight_map) m.maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureBase(names.highlight_map, names.base);
-        else
-            RL_FREE(names.highlight_map);
-        if (names.bump_map) m.maps[MATERIAL_MAP_NORMAL].texture = LoadTextureBase(names.bump_map, names.base);
-        else
-            RL_FREE(names.bump_map);
-
-        // Free unused maps (used ones are freed in LoadTextureBase because of reallocates)
-        RL_FREE(names.alpha_map);
-        RL_FREE(names.ambient_map);
-        RL_FREE(names.decal_map);
-        RL_FREE(names.displacement_map);
+        char *maps[OBJ_MAP_COUNT];
+        TakeMatMaps(names, maps);
+        for (int j = 0; j < OBJ_MAP_COUNT; j++) AddTextureJob(&textures, maps[j], NULL, 0, i, objMapSlots[j]);
 
         model.materials[i] = m;
     }
 
-    for (int i = 0; i < mesh_count; i++) {
-        for (int j = 0; j < file.mat_count; j++) {
-            if (file.mats[j].name_hash == meshes[i].mat_hash)
-                model.meshMaterial[i] = j;
-        }
-        model.meshes[i] = meshes[i].mesh;
+    LoadTextureJobs(&textures, model.materials);
+
+    for (int i = 0; i < obj.mesh_count; i++) {
+        model.meshMaterial[i] = FindObjMat(obj, obj.meshes[i]);
+        model.meshes[i] = obj.meshes[i].mesh;
     }
 
-    RL_FREE(meshes);
-    RL_FREE(file.mats);
-    RL_FREE(file.base);
+    RL_FREE(obj.meshes);
+    RL_FREE(obj.mats);
 
     return model;
 }
 
+void UnloadObjDry(Model model) {
+    for (int i = 0; i < model.meshCount; i++) {
+        RL_FREE(model.meshes[i].vertices);
+        RL_FREE(model.meshes[i].texcoords);
+        RL_FREE(model.meshes[i].normals);
+    }
+    for (int i = 0; i < model.materialCount; i++) UnloadMaterial(model.materials[i]);
+
+    RL_FREE(model.meshes);
+    RL_FREE(model.materials);
+    RL_FREE(model.meshMaterial);
+}
+
+// Adds a default material if there is none and uploads all meshes
+void UploadObj(Model *obj, unsigned int flags) {
+    if (obj->materialCount == 0) {
+        obj->materialCount = 1;
+        obj->materials = RL_CALLOC(1, sizeof(Material));
+        obj->materials[0] = LoadMaterialDefault();
+    }
+
+    for (int i = 0; i < obj->meshCount; i++) {
+        UploadMesh(&obj->meshes[i], false);
+
+        if (flags & OBJ_LOAD_FREE_CPU_DATA) {
+            RL_FREE(obj->meshes[i].vertices);
+            RL_FREE(obj->meshes[i].texcoords);
+            RL_FREE(obj->meshes[i].normals);
+            obj->meshes[i].vertices = NULL;
+            obj->meshes[i].texcoords = NULL;
+            obj->meshes[i].normals = NULL;
+        }
+    }
+}
+
+// Bounds of the vertices of a mesh, zero for meshes without vertices
+BoundingBox GetMeshBounds(Mesh mesh) {
+    BoundingBox bounds = {0};
+    if (mesh.vertexCount == 0 || !mesh.vertices) return bounds;
+
+    bounds.min = bounds.max = (Vector3) {mesh.vertices[0], mesh.vertices[1], mesh.vertices[2]};
+    for (int i = 1; i < mesh.vertexCount; i++) {
+        Vector3 v = {mesh.vertices[i * 3], mesh.vertices[i * 3 + 1], mesh.vertices[i * 3 + 2]};
+        bounds.min = Vector3Min(bounds.min, v);
+        bounds.max = Vector3Max(bounds.max, v);
+    }
+    return bounds;
+}
+
+// Adds a mesh to the statistics of a model, empty is true until the first mesh with vertices was added
+void AddMeshStats(ObjModelStats *stats, bool *empty, int vertex_count, int triangle_count, BoundingBox bounds) {
+    stats->vertexCount += vertex_count;
+    stats->triangleCount += triangle_count;
+    if (vertex_count == 0) return;
+
+    if (*empty) {
+        stats->bounds = bounds;
+        *empty = false;
+    } else {
+        stats->bounds.min = Vector3Min(stats->bounds.min, bounds.min);
+        stats->bounds.max = Vector3Max(stats->bounds.max, bounds.max);
+    }
+}
+
+// Has to run before the vertex data may be freed
+ObjModelStats GetObjStats(Model obj) {
+    ObjModelStats stats = {0};
+    bool empty = true;
+
+    for (int i = 0; i < obj.meshCount; i++) {
+        Mesh mesh = obj.meshes[i];
+        AddMeshStats(&stats, &empty, mesh.vertices ? mesh.vertexCount : 0, mesh.triangleCount, GetMeshBounds(mesh));
+    }
+
+    return stats;
+}
+
+// Bytes of all mip levels of a texture
+unsigned long long GetTextureDataSize(Texture texture) {
+    unsigned long long size = 0;
+    int width = texture.width, height = texture.height;
+
+    for (int i = 0; i < (texture.mipmaps > 1 ? texture.mipmaps : 1); i++) {
+        size += GetPixelDataSize(width, height, texture.format);
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return size;
+}
+
+ObjMemoryUsage GetObjMemoryUsage(Model model) {
+    ObjMemoryUsage usage = {0};
+
+    usage.cpuBytes += sizeof(Mesh) * model.meshCount + sizeof(int) * model.meshCount;
+    usage.cpuBytes += sizeof(Material) * model.materialCount;
+    usage.cpuBytes += (sizeof(BoneInfo) + sizeof(Transform)) * model.boneCount;
+
+    for (int i = 0; i < model.meshCount; i++) {
+        Mesh mesh = model.meshes[i];
+        unsigned long long vc = mesh.vertexCount, ic = (unsigned long long) mesh.triangleCount * 3;
+
+        // Size of each attribute, in the order UploadMesh of raylib 4.0 assigns vboId
+        // This is all rlobj uploads, later raylib versions add bone buffers in slots that aren't counted here
+        unsigned long long sizes[MAX_MESH_VERTEX_BUFFERS] = {
+            vc * 3 * sizeof(float),             // vertices
+            vc * 2 * sizeof(float),             // texcoords
+            vc * 3 * sizeof(float),             // normals
+            vc * 4 * sizeof(unsigned char),     // colors
+            vc * 4 * sizeof(float),             // tangents
+            vc * 2 * sizeof(float),             // texcoords2
+            ic * sizeof(unsigned short),        // indices
+        };
+        void *arrays[MAX_MESH_VERTEX_BUFFERS] = {
+            mesh.vertices, mesh.texcoords, mesh.normals, mesh.colors, mesh.tangents, mesh.texcoords2, mesh.indices
+        };
+
+        for (int j = 0; j < MAX_MESH_VERTEX_BUFFERS; j++) {
+            if (arrays[j]) usage.cpuBytes += sizes[j];
+            if (mesh.vboId && mesh.vboId[j]) usage.gpuBytes += sizes[j];
+        }
+
+        if (mesh.animVertices) usage.cpuBytes += sizes[0];
+        if (mesh.animNormals) usage.cpuBytes += sizes[2];
+        if (mesh.boneIds) usage.cpuBytes += vc * 4 * sizeof(unsigned char);
+        if (mesh.boneWeights) usage.cpuBytes += vc * 4 * sizeof(float);
+        if (mesh.vboId) usage.cpuBytes += MAX_MESH_VERTEX_BUFFERS * sizeof(unsigned int);
+    }
+
+    // Textures can be shared between maps, but the default texture isn't owned by the model
+    unsigned int *counted = RL_CALLOC(model.materialCount * MAX_MATERIAL_MAPS + 1, sizeof(unsigned int));
+    int counted_count = 0;
+
+    for (int i = 0; i < model.materialCount; i++) {
+        if (!model.materials[i].maps) continue;
+        usage.cpuBytes += MAX_MATERIAL_MAPS * sizeof(MaterialMap);
+
+        for (int j = 0; j < MAX_MATERIAL_MAPS; j++) {
+            Texture texture = model.materials[i].maps[j].texture;
+            if (texture.id == 0 || texture.id == rlGetTextureIdDefault()) continue;
+
+            bool seen = false;
+            for (int k = 0; k < counted_count && !seen; k++) seen = counted[k] == texture.id;
+            if (seen) continue;
+
+            counted[counted_count++] = texture.id;
+            usage.gpuBytes += GetTextureDataSize(texture);
+        }
+    }
+    RL_FREE(counted);
+
+    return usage;
+}
+
+Model LoadObjWithStats(const char *filename, unsigned int flags, ObjModelStats *stats) {
+    Model obj = LoadObjDry(filename, flags);
+
+    ObjModelStats res = GetObjStats(obj);
+    UploadObj(&obj, flags);
+    res.memory = GetObjMemoryUsage(obj);
+
+    if (stats) *stats = res;
+    return obj;
+}
+
 // Wrapper around LoadObjDry
 // This basically does the same job as LoadMaterial does for LoadOBJ
+Model LoadObjEx(const char *filename, unsigned int flags) {
+    Model obj = LoadObjDry(filename, flags);
+    UploadObj(&obj, flags);
+    return obj;
+}
+
 Model LoadObj(const char *filename) {
-    Model obj = LoadObjDry(filename);
+    return LoadObjEx(filename, OBJ_LOAD_DEFAULT);
+}
+
+// Instancing
+
+typedef struct ValidMatrix { Matrix m; bool valid; } ValidMatrix;
+
+#define InvalidMatrix (ValidMatrix){(Matrix){0}, false}
 
-    if (obj.materialCount == 0) {
-        obj.materialCount = 1;
-        obj.materials = RL_CALLOC(1, sizeof(Material));
-        obj.materials[0] = LoadMaterialDefault();
+Vector3 MeshVertex(Mesh mesh, int i) {
+    return (Vector3) {mesh.vertices[i * 3], mesh.vertices[i * 3 + 1], mesh.vertices[i * 3 + 2]};
+}
+
+// Summed in double, a float sum loses the precision of meshes far from the origin
+Vector3 MeshCentroid(Mesh mesh) {
+    double x = 0., y = 0., z = 0.;
+    for (int i = 0; i < mesh.vertexCount; i++) {
+        x += mesh.vertices[i * 3];
+        y += mesh.vertices[i * 3 + 1];
+        z += mesh.vertices[i * 3 + 2];
     }
+    return (Vector3) {(float) (x / mesh.vertexCount), (float) (y / mesh.vertexCount), (float) (z / mesh.vertexCount)};
+}
 
-    for (int i = 0; i < obj.meshCount; i++) {
-        UploadMesh(&obj.meshes[i], false);
+// Builds an orthonormal frame from two vectors, columns are the axes
+Matrix FrameFromVectors(Vector3 u, Vector3 w) {
+    Vector3 x = Vector3Normalize(u);
+    Vector3 z = Vector3Normalize(Vector3CrossProduct(u, w));
+    Vector3 y = Vector3CrossProduct(z, x);
+    return (Matrix) {
+        x.x, y.x, z.x, 0.f,
+        x.y, y.y, z.y, 0.f,
+        x.z, y.z, z.z, 0.f,
+        0.f, 0.f, 0.f, 1.f
+    };
+}
+
+// Finds the rotation and translation that maps every vertex of a onto the vertex with the same index in b
+// Exporters keep the vertex order when baking transforms, so no matching between the vertex sets is needed
+ValidMatrix FindRigidTransform(Mesh a, Mesh b) {
+    if (a.vertexCount != b.vertexCount || a.vertexCount < 3) return InvalidMatrix;
+    if (memcmp(a.texcoords, b.texcoords, sizeof(float) * a.vertexCount * 2) != 0) return InvalidMatrix;
+
+    Vector3 ca = MeshCentroid(a), cb = MeshCentroid(b);
+
+    // Pick two vertices that span a plane with the centroid, to build one frame per mesh from them
+    int i1 = 0, i2 = 0;
+    float best = 0.f;
+    for (int i = 0; i < a.vertexCount; i++) {
+        float d = Vector3LengthSqr(Vector3Subtract(MeshVertex(a, i), ca));
+        if (d > best) { best = d; i1 = i; }
+    }
+    if (best == 0.f) return InvalidMatrix;
+    float radius = sqrtf(best);
+
+    Vector3 u = Vector3Subtract(MeshVertex(a, i1), ca);
+    best = 0.f;
+    for (int i = 0; i < a.vertexCount; i++) {
+        float d = Vector3LengthSqr(Vector3CrossProduct(u, Vector3Subtract(MeshVertex(a, i), ca)));
+        if (d > best) { best = d; i2 = i; }
+    }
+    if (best <= 1e-8f * radius * radius * radius * radius) return InvalidMatrix; // all vertices on one line
+
+    Matrix fa = FrameFromVectors(u, Vector3Subtract(MeshVertex(a, i2), ca));
+    Matrix fb = FrameFromVectors(Vector3Subtract(MeshVertex(b, i1), cb), Vector3Subtract(MeshVertex(b, i2), cb));
+
+    // Rotation from a's frame into b's frame, then move a's centroid onto b's
+    Matrix m = MatrixMultiply(MatrixTranspose(fa), fb);
+    Vector3 t = Vector3Subtract(cb, Vector3Transform(ca, m));
+    m.m12 = t.x;
+    m.m13 = t.y;
+    m.m14 = t.z;
+
+    // Baked coordinates are rounded relative to their distance from the origin, not to the mesh's size, so copies far
+    // away need a tolerance of a few float steps at that distance
+    float magnitude = sqrtf(fmaxf(Vector3LengthSqr(ca), Vector3LengthSqr(cb))) + radius;
+    float tolerance = 1e-4f * (radius > 1.f ? radius : 1.f) + 8.f * FLT_EPSILON * magnitude;
+    for (int i = 0; i < a.vertexCount; i++) {
+        Vector3 d = Vector3Subtract(Vector3Transform(MeshVertex(a, i), m), MeshVertex(b, i));
+        if (Vector3LengthSqr(d) > tolerance * tolerance) return InvalidMatrix;
     }
 
-    return obj;
+    // The rotation is only as exact as the vertices it was derived from
+    float normal_tolerance = 1e-3f + tolerance / radius;
+    Matrix r = m;
+    r.m12 = r.m13 = r.m14 = 0.f;
+    for (int i = 0; i < a.vertexCount; i++) {
+        Vector3 na = {a.normals[i * 3], a.normals[i * 3 + 1], a.normals[i * 3 + 2]};
+        Vector3 nb = {b.normals[i * 3], b.normals[i * 3 + 1], b.normals[i * 3 + 2]};
+        if (Vector3LengthSqr(Vector3Subtract(Vector3Transform(na, r), nb)) > normal_tolerance * normal_tolerance)
+            return InvalidMatrix;
+    }
+
+    return (ValidMatrix) {m, true};
+}
+
+// Wrapper around LoadObjDry
+// Meshes that only differ by a rigid transform are stored once, before anything is uploaded
+ObjInstancedModel LoadObjInstanced(const char *filename, unsigned int flags) {
+    ObjInstancedModel res = {0};
+    res.model = LoadObjDry(filename, flags);
+
+    Model *obj = &res.model;
+    res.transforms = (Matrix **) RL_CALLOC(obj->meshCount, sizeof(Matrix *));
+    res.instanceCounts = (int *) RL_CALLOC(obj->meshCount, sizeof(int));
+
+    int mesh_count = obj->meshCount, canonical_count = 0;
+    for (int i = 0; i < mesh_count; i++) {
+        Mesh mesh = obj->meshes[i];
+        bool instanced = false;
+
+        for (int c = 0; c < canonical_count && !instanced; c++) {
+            if (obj->meshMaterial[c] != obj->meshMaterial[i]) continue;
+
+            ValidMatrix vm = FindRigidTransform(obj->meshes[c], mesh);
+            if (!vm.valid) continue;
+
+            res.transforms[c] = (Matrix *) RL_REALLOC(res.transforms[c], sizeof(Matrix) * ++res.instanceCounts[c]);
+            res.transforms[c][res.instanceCounts[c] - 1] = vm.m;
+            instanced = true;
+        }
+
+        if (instanced) {
+            // Three floats per vertex and normal, two per texcoord, minus the matrix that replaces them
+            res.memorySaved += (unsigned long long) mesh.vertexCount * 8 * sizeof(float) - sizeof(Matrix);
+            RL_FREE(mesh.vertices);
+            RL_FREE(mesh.texcoords);
+            RL_FREE(mesh.normals);
+        } else {
+            res.transforms[canonical_count] = (Matrix *) RL_CALLOC(1, sizeof(Matrix));
+            res.transforms[canonical_count][0] = MatrixIdentity();
+            res.instanceCounts[canonical_count] = 1;
+            obj->meshMaterial[canonical_count] = obj->meshMaterial[i];
+            obj->meshes[canonical_count++] = mesh;
+        }
+    }
+    obj->meshCount = canonical_count;
+
+    if (canonical_count != mesh_count)
+        TraceLog(LOG_INFO, "MODEL: [%s] Instancing stores %i of %i meshes, saved %llu bytes", filename, canonical_count,
+                 mesh_count, res.memorySaved);
+
+    UploadObj(obj, flags);
+    return res;
+}
+
+// DrawMeshInstanced passes the transforms as the attribute at SHADER_LOC_MATRIX_MODEL
+// Shaders without it (like the default shader) would get their vertex attributes overwritten, so these draw every
+// instance on its own
+void DrawObjInstanced(ObjInstancedModel model) {
+    for (int i = 0; i < model.model.meshCount; i++) {
+        Mesh mesh = model.model.meshes[i];
+        Material material = model.model.materials[model.model.meshMaterial[i]];
+
+        if (material.shader.locs && material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) {
+            DrawMeshInstanced(mesh, material, model.transforms[i], model.instanceCounts[i]);
+        } else {
+            for (int j = 0; j < model.instanceCounts[i]; j++) DrawMesh(mesh, material, model.transforms[i][j]);
+        }
+    }
+}
+
+void UnloadObjInstanced(ObjInstancedModel model) {
+    for (int i = 0; i < model.model.meshCount; i++) RL_FREE(model.transforms[i]);
+    RL_FREE(model.transforms);
+    RL_FREE(model.instanceCounts);
+    UnloadModel(model.model);
+}
+
+// Archives
+
+// Layout of an archive, all values are stored in native byte order:
+//  ArchiveHeader
+//  Entry data: textures as their original files, models as ArchiveModel, ArchiveMaterial[], ArchiveMesh[] followed
+//   by the vertex arrays, every array ARCHIVE_ALIGN aligned so it can be uploaded straight from the mapped file
+//  ArchiveEntry[entry_count]
+//  Names of all entries, zero terminated
+//  Name index, open addressing with linear probing on the name hash
+
+#define ARCHIVE_MAGIC "RLOBJPK"
+#define ARCHIVE_VERSION 2
+#define ARCHIVE_ALIGN 16
+
+typedef enum ArchiveEntryType {
+    ARCHIVE_ENTRY_MODEL = 1,
+    ARCHIVE_ENTRY_TEXTURE = 2,
+} ArchiveEntryType;
+
+typedef struct ArchiveHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t bucket_count;          // Power of two
+    uint32_t reserved;
+    uint64_t entries_offset;
+    uint64_t buckets_offset;        // uint32_t per bucket, entry index + 1 or 0 if empty
+} ArchiveHeader;
+
+typedef struct ArchiveEntry {
+    uint32_t name_hash;
+    uint32_t type;
+    uint32_t name_length;
+    uint32_t reserved;
+    uint64_t name_offset;
+    uint64_t data_offset;
+    uint64_t data_size;
+} ArchiveEntry;
+
+typedef struct ArchiveModel {
+    uint32_t mesh_count;
+    uint32_t material_count;
+} ArchiveModel;
+
+typedef struct ArchiveMaterial {
+    Color albedo, metalness;
+    uint32_t maps[OBJ_MAP_COUNT];   // Texture entry index + 1 or 0 if there is no map
+} ArchiveMaterial;
+
+typedef struct ArchiveMesh {
+    uint32_t vertex_count;
+    uint32_t triangle_count;
+    uint32_t material;
+    uint32_t reserved;
+    BoundingBox bounds;             // Kept, so it's available without the vertex data
+    uint64_t vertices_offset, texcoords_offset, normals_offset;
+} ArchiveMesh;
+
+typedef struct ArchiveWriter {
+    FILE *file;
+    uint64_t offset;
+
+    ArchiveEntry *entries;
+    char **names;
+    int entry_count;
+} ArchiveWriter;
+
+uint32_t ArchiveHash(const char *name) {
+    return (uint32_t) hash((unsigned char *) name);
+}
+
+uint64_t AlignOffset(uint64_t offset, uint64_t align) {
+    return (offset + align - 1) / align * align;
+}
+
+void WriteArchive(ArchiveWriter *writer, const void *data, uint64_t size) {
+    fwrite(data, 1, size, writer->file);
+    writer->offset += size;
+}
+
+void PadArchive(ArchiveWriter *writer, uint64_t align) {
+    static const char zeros[ARCHIVE_ALIGN] = {0};
+    WriteArchive(writer, zeros, AlignOffset(writer->offset, align) - writer->offset);
+}
+
+// Returns the index of the entry, or -1
+int FindWrittenEntry(ArchiveWriter *writer, const char *name, uint32_t type) {
+    uint32_t name_hash = ArchiveHash(name);
+    for (int i = 0; i < writer->entry_count; i++) {
+        if (writer->entries[i].name_hash == name_hash && writer->entries[i].type == type && strcmp(writer->names[i], name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+int AddArchiveEntry(ArchiveWriter *writer, const char *name, uint32_t type, uint64_t data_offset, uint64_t data_size) {
+    writer->entries = (ArchiveEntry *) RL_REALLOC(writer->entries, sizeof(ArchiveEntry) * (writer->entry_count + 1));
+    writer->names = (char **) RL_REALLOC(writer->names, sizeof(char *) * (writer->entry_count + 1));
+
+    writer->entries[writer->entry_count] = (ArchiveEntry) {
+        .name_hash = ArchiveHash(name), .type = type, .name_length = (uint32_t) strlen(name),
+        .data_offset = data_offset, .data_size = data_size
+    };
+    writer->names[writer->entry_count] = PutStringOnHeap(name);
+    return writer->entry_count++;
+}
+
+// Returns the texture entry index + 1, or 0 if the file can't be read
+uint32_t WriteArchiveTexture(ArchiveWriter *writer, const char *filename) {
+    int index = FindWrittenEntry(writer, filename, ARCHIVE_ENTRY_TEXTURE);
+    if (index >= 0) return index + 1;
+
+    unsigned int size = 0;
+    unsigned char *data = LoadFileData(filename, &size);
+    if (!data) return 0;
+
+    PadArchive(writer, ARCHIVE_ALIGN);
+    uint64_t offset = writer->offset;
+    WriteArchive(writer, data, size);
+    UnloadFileData(data);
+
+    return AddArchiveEntry(writer, filename, ARCHIVE_ENTRY_TEXTURE, offset, size) + 1;
+}
+
+bool WriteArchiveModel(ArchiveWriter *writer, const char *filename) {
+    if (FindWrittenEntry(writer, filename, ARCHIVE_ENTRY_MODEL) >= 0) {
+        TraceLog(LOG_WARNING, "MODEL: [%s] Already in archive, skipping", filename);
+        return true;
+    }
+
+    ParsedObj obj = ParseObj(filename, OBJ_LOAD_DEFAULT);
+    if (!obj.valid) return false;
+
+    ArchiveModel header = {.mesh_count = (uint32_t) obj.mesh_count, .material_count = (uint32_t) obj.mat_count};
+    ArchiveMaterial *materials = (ArchiveMaterial *) RL_CALLOC(obj.mat_count, sizeof(ArchiveMaterial));
+    ArchiveMesh *meshes = (ArchiveMesh *) RL_CALLOC(obj.mesh_count, sizeof(ArchiveMesh));
+
+    // Textures go in front of the model, so the model's own data stays in one piece
+    for (int i = 0; i < obj.mat_count; i++) {
+        materials[i].albedo = Vector3ToColor(obj.mats[i].diffuse, obj.mats[i].opacity);
+        materials[i].metalness = Vector3ToColor(obj.mats[i].specular, obj.mats[i].opacity);
+
+        char *maps[OBJ_MAP_COUNT];
+        TakeMatMaps(obj.mats[i], maps);
+        for (int j = 0; j < OBJ_MAP_COUNT; j++) {
+            if (!maps[j]) continue;
+            materials[i].maps[j] = WriteArchiveTexture(writer, maps[j]);
+            if (!materials[i].maps[j]) TraceLog(LOG_WARNING, "MODEL: [%s] Failed to read map %s", filename, maps[j]);
+            RL_FREE(maps[j]);
+        }
+    }
+
+    PadArchive(writer, ARCHIVE_ALIGN);
+    uint64_t start = writer->offset;
+
+    // Vertex arrays follow the tables, so all offsets are known before writing
+    uint64_t offset = start + sizeof(ArchiveModel) + sizeof(ArchiveMaterial) * obj.mat_count + sizeof(ArchiveMesh) * obj.mesh_count;
+    for (int i = 0; i < obj.mesh_count; i++) {
+        Mesh mesh = obj.meshes[i].mesh;
+        meshes[i].vertex_count = (uint32_t) mesh.vertexCount;
+        meshes[i].triangle_count = (uint32_t) mesh.triangleCount;
+        meshes[i].material = (uint32_t) FindObjMat(obj, obj.meshes[i]);
+        meshes[i].bounds = GetMeshBounds(mesh);
+        if (mesh.vertexCount == 0) continue;
+
+        meshes[i].vertices_offset = AlignOffset(offset, ARCHIVE_ALIGN);
+        meshes[i].texcoords_offset = AlignOffset(meshes[i].vertices_offset + sizeof(float) * 3 * mesh.vertexCount, ARCHIVE_ALIGN);
+        meshes[i].normals_offset = AlignOffset(meshes[i].texcoords_offset + sizeof(float) * 2 * mesh.vertexCount, ARCHIVE_ALIGN);
+        offset = meshes[i].normals_offset + sizeof(float) * 3 * mesh.vertexCount;
+    }
+
+    WriteArchive(writer, &header, sizeof(ArchiveModel));
+    WriteArchive(writer, materials, sizeof(ArchiveMaterial) * obj.mat_count);
+    WriteArchive(writer, meshes, sizeof(ArchiveMesh) * obj.mesh_count);
+
+    for (int i = 0; i < obj.mesh_count; i++) {
+        Mesh mesh = obj.meshes[i].mesh;
+        if (mesh.vertexCount != 0) {
+            PadArchive(writer, ARCHIVE_ALIGN);
+            WriteArchive(writer, mesh.vertices, sizeof(float) * 3 * mesh.vertexCount);
+            PadArchive(writer, ARCHIVE_ALIGN);
+            WriteArchive(writer, mesh.texcoords, sizeof(float) * 2 * mesh.vertexCount);
+            PadArchive(writer, ARCHIVE_ALIGN);
+            WriteArchive(writer, mesh.normals, sizeof(float) * 3 * mesh.vertexCount);
+        }
+
+        RL_FREE(mesh.vertices);
+        RL_FREE(mesh.texcoords);
+        RL_FREE(mesh.normals);
+    }
+
+    AddArchiveEntry(writer, filename, ARCHIVE_ENTRY_MODEL, start, writer->offset - start);
+
+    RL_FREE(materials);
+    RL_FREE(meshes);
+    RL_FREE(obj.meshes);
+    RL_FREE(obj.mats);
+    return true;
+}
+
+bool ExportObjArchive(const char *filename, const char **objFiles, int count) {
+    ArchiveWriter writer = {0};
+    writer.file = fopen(filename, "wb");
+    if (!writer.file) {
+        TraceLog(LOG_WARNING, "FILEIO: [%s] Failed to open archive for writing", filename);
+        return false;
+    }
+
+    bool success = true;
+    ArchiveHeader header = {.magic = ARCHIVE_MAGIC, .version = ARCHIVE_VERSION};
+    WriteArchive(&writer, &header, sizeof(ArchiveHeader));
+
+    for (int i = 0; i < count; i++) {
+        if (!WriteArchiveModel(&writer, objFiles[i])) {
+            TraceLog(LOG_WARNING, "MODEL: [%s] Failed to load OBJ for archive", objFiles[i]);
+            success = false;
+        }
+    }
+
+    // Names are stored right after the entries
+    PadArchive(&writer, ARCHIVE_ALIGN);
+    header.entry_count = (uint32_t) writer.entry_count;
+    header.entries_offset = writer.offset;
+    uint64_t name_offset = writer.offset + sizeof(ArchiveEntry) * writer.entry_count;
+    for (int i = 0; i < writer.entry_count; i++) {
+        writer.entries[i].name_offset = name_offset;
+        name_offset += writer.entries[i].name_length + 1;
+    }
+    WriteArchive(&writer, writer.entries, sizeof(ArchiveEntry) * writer.entry_count);
+    for (int i = 0; i < writer.entry_count; i++) WriteArchive(&writer, writer.names[i], writer.entries[i].name_length + 1);
+
+    // Keep the index at most half full, so probe sequences stay short
+    header.bucket_count = 16;
+    while (header.bucket_count < (uint32_t) writer.entry_count * 2) header.bucket_count *= 2;
+    uint32_t *buckets = (uint32_t *) RL_CALLOC(header.bucket_count, sizeof(uint32_t));
+    for (int i = 0; i < writer.entry_count; i++) {
+        uint32_t b = writer.entries[i].name_hash & (header.bucket_count - 1);
+        while (buckets[b]) b = (b + 1) & (header.bucket_count - 1);
+        buckets[b] = (uint32_t) i + 1;
+    }
+
+    PadArchive(&writer, ARCHIVE_ALIGN);
+    header.buckets_offset = writer.offset;
+    WriteArchive(&writer, buckets, sizeof(uint32_t) * header.bucket_count);
+
+    fseek(writer.file, 0, SEEK_SET);
+    fwrite(&header, 1, sizeof(ArchiveHeader), writer.file);
+    if (ferror(writer.file)) success = false;
+    fclose(writer.file);
+
+    for (int i = 0; i < writer.entry_count; i++) RL_FREE(writer.names[i]);
+    RL_FREE(writer.names);
+    RL_FREE(writer.entries);
+    RL_FREE(buckets);
+
+    if (success) TraceLog(LOG_INFO, "FILEIO: [%s] Archive written, %i entries", filename, writer.entry_count);
+    return success;
+}
+
+bool RangeInArchive(ObjArchive archive, uint64_t offset, uint64_t size) {
+    return offset <= archive.size && size <= archive.size - offset;
+}
+
+bool ValidateArchive(ObjArchive archive) {
+    if (!RangeInArchive(archive, 0, sizeof(ArchiveHeader))) return false;
+
+    const ArchiveHeader *header = (const ArchiveHeader *) archive.data;
+    if (memcmp(header->magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) != 0 || header->version != ARCHIVE_VERSION) return false;
+    if (header->bucket_count == 0 || (header->bucket_count & (header->bucket_count - 1)) != 0) return false;
+    if (header->entries_offset % ARCHIVE_ALIGN || header->buckets_offset % ARCHIVE_ALIGN) return false;
+    if (!RangeInArchive(archive, header->entries_offset, sizeof(ArchiveEntry) * (uint64_t) header->entry_count)) return false;
+    if (!RangeInArchive(archive, header->buckets_offset, sizeof(uint32_t) * (uint64_t) header->bucket_count)) return false;
+
+    const ArchiveEntry *entries = (const ArchiveEntry *) (archive.data + header->entries_offset);
+    for (uint32_t i = 0; i < header->entry_count; i++) {
+        if (!RangeInArchive(archive, entries[i].name_offset, entries[i].name_length + 1ull)) return false;
+        if (archive.data[entries[i].name_offset + entries[i].name_length] != '\0') return false;
+        if (!RangeInArchive(archive, entries[i].data_offset, entries[i].data_size)) return false;
+        if (entries[i].data_offset % ARCHIVE_ALIGN) return false;
+        // Images are decoded from memory with an int size
+        if (entries[i].type == ARCHIVE_ENTRY_TEXTURE && entries[i].data_size > INT_MAX) return false;
+    }
+
+    const uint32_t *buckets = (const uint32_t *) (archive.data + header->buckets_offset);
+    for (uint32_t i = 0; i < header->bucket_count; i++) {
+        if (buckets[i] > header->entry_count) return false;
+    }
+    return true;
+}
+
+ObjArchive LoadObjArchive(const char *filename) {
+    ObjArchive archive = {0};
+
+#ifndef RLOBJ_NO_MMAP
+    int fd = open(filename, O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                archive.data = (unsigned char *) data;
+                archive.size = (unsigned long long) st.st_size;
+                archive.mapped = true;
+            }
+        }
+        close(fd); // The mapping stays valid
+    }
+#endif
+
+    if (!archive.data) {
+        unsigned int size = 0;
+        archive.data = LoadFileData(filename, &size);
+        archive.size = size;
+    }
+
+    if (!archive.data) {
+        TraceLog(LOG_WARNING, "FILEIO: [%s] Failed to open archive", filename);
+        return (ObjArchive) {0};
+    }
+
+    if (!ValidateArchive(archive)) {
+        TraceLog(LOG_WARNING, "FILEIO: [%s] Not a valid rlobj archive", filename);
+        UnloadObjArchive(archive);
+        return (ObjArchive) {0};
+    }
+
+    return archive;
+}
+
+void UnloadObjArchive(ObjArchive archive) {
+    if (!archive.data) return;
+#ifndef RLOBJ_NO_MMAP
+    if (archive.mapped) {
+        munmap(archive.data, archive.size);
+        return;
+    }
+#endif
+    UnloadFileData(archive.data);
+}
+
+const ArchiveEntry *FindArchiveEntry(ObjArchive archive, const char *name, uint32_t type) {
+    if (!archive.data) return NULL;
+
+    const ArchiveHeader *header = (const ArchiveHeader *) archive.data;
+    const ArchiveEntry *entries = (const ArchiveEntry *) (archive.data + header->entries_offset);
+    const uint32_t *buckets = (const uint32_t *) (archive.data + header->buckets_offset);
+
+    uint32_t name_hash = ArchiveHash(name), name_length = (uint32_t) strlen(name);
+    uint32_t mask = header->bucket_count - 1;
+
+    for (uint32_t b = name_hash & mask, probes = 0; buckets[b] && probes <= mask; b = (b + 1) & mask, probes++) {
+        const ArchiveEntry *entry = &entries[buckets[b] - 1];
+        if (entry->name_hash == name_hash && entry->type == type && entry->name_length == name_length &&
+            memcmp(archive.data + entry->name_offset, name, name_length) == 0)
+            return entry;
+    }
+    return NULL;
+}
+
+// Returns the entry with the given index + 1 if it's a texture
+const ArchiveEntry *GetArchiveTexture(ObjArchive archive, uint32_t index) {
+    const ArchiveHeader *header = (const ArchiveHeader *) archive.data;
+    if (index == 0 || index > header->entry_count) return NULL;
+
+    const ArchiveEntry *entry = (const ArchiveEntry *) (archive.data + header->entries_offset) + (index - 1);
+    return entry->type == ARCHIVE_ENTRY_TEXTURE ? entry : NULL;
+}
+
+Model LoadObjFromArchiveWithStats(ObjArchive archive, const char *name, unsigned int flags, ObjModelStats *stats) {
+    const ArchiveEntry *entry = FindArchiveEntry(archive, name, ARCHIVE_ENTRY_MODEL);
+    if (!entry || entry->data_size < sizeof(ArchiveModel)) {
+        TraceLog(LOG_WARNING, "MODEL: [%s] Not found in archive", name);
+        return (Model) {0};
+    }
+
+    const unsigned char *data = archive.data + entry->data_offset;
+    ArchiveModel header = *(const ArchiveModel *) data;
+    const ArchiveMaterial *materials = (const ArchiveMaterial *) (data + sizeof(ArchiveModel));
+    const ArchiveMesh *meshes = (const ArchiveMesh *) (materials + header.material_count);
+
+    uint64_t tables = sizeof(ArchiveModel) + sizeof(ArchiveMaterial) * (uint64_t) header.material_count + sizeof(ArchiveMesh) * (uint64_t) header.mesh_count;
+    if (tables > entry->data_size) {
+        TraceLog(LOG_WARNING, "MODEL: [%s] Archive entry is corrupted", name);
+        return (Model) {0};
+    }
+
+    Model model = {0};
+    model.transform = MatrixIdentity();
+    model.meshCount = (int) header.mesh_count;
+    model.meshes = (Mesh *) RL_CALLOC(model.meshCount, sizeof(Mesh));
+    model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
+
+    model.materialCount = header.material_count ? (int) header.material_count : 1;
+    model.materials = RL_CALLOC(model.materialCount, sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+
+    TextureBatch textures = {
+        .jobs = NULL, .count = 0, .mipmaps = (flags & OBJ_LOAD_GEN_MIPMAPS) != 0,
+        .parallel = (flags & OBJ_LOAD_PARALLEL_IMAGES) != 0
+    };
+
+    for (int i = 0; i < (int) header.material_count; i++) {
+        if (i != 0) model.materials[i] = LoadMaterialDefault();
+        model.materials[i].maps[MATERIAL_MAP_ALBEDO].color = materials[i].albedo;
+        model.materials[i].maps[MATERIAL_MAP_METALNESS].color = materials[i].metalness;
+
+        // Images are decoded straight from the archive
+        for (int j = 0; j < OBJ_MAP_COUNT; j++) {
+            const ArchiveEntry *texture = GetArchiveTexture(archive, materials[i].maps[j]);
+            if (!texture) continue;
+            char *texture_name = PutStringOnHeap((const char *) archive.data + texture->name_offset);
+            AddTextureJob(&textures, texture_name, archive.data + texture->data_offset, (int) texture->data_size, i, objMapSlots[j]);
+        }
+    }
+
+    LoadTextureJobs(&textures, model.materials);
+
+    ObjModelStats res = {0};
+    bool empty = true;
+
+    for (int i = 0; i < model.meshCount; i++) {
+        ArchiveMesh am = meshes[i];
+        model.meshMaterial[i] = am.material < header.material_count ? (int) am.material : 0;
+        if (am.vertex_count == 0) continue;
+
+        // The arrays are used in place, so they have to be aligned as well as in range
+        uint64_t vc = am.vertex_count;
+        if (am.vertices_offset % ARCHIVE_ALIGN || am.texcoords_offset % ARCHIVE_ALIGN || am.normals_offset % ARCHIVE_ALIGN ||
+            !RangeInArchive(archive, am.vertices_offset, sizeof(float) * 3 * vc) ||
+            !RangeInArchive(archive, am.texcoords_offset, sizeof(float) * 2 * vc) ||
+            !RangeInArchive(archive, am.normals_offset, sizeof(float) * 3 * vc)) {
+            TraceLog(LOG_WARNING, "MODEL: [%s] Archive mesh %i is corrupted", name, i);
+            continue;
+        }
+
+        // Upload straight from the archive, the arrays only get copied if they should be kept in RAM
+        Mesh mesh = {0};
+        mesh.vertexCount = (int) am.vertex_count;
+        mesh.triangleCount = (int) am.triangle_count;
+        mesh.vertices = (float *) (archive.data + am.vertices_offset);
+        mesh.texcoords = (float *) (archive.data + am.texcoords_offset);
+        mesh.normals = (float *) (archive.data + am.normals_offset);
+        UploadMesh(&mesh, false);
+
+        if (flags & OBJ_LOAD_FREE_CPU_DATA) {
+            mesh.vertices = NULL;
+            mesh.texcoords = NULL;
+            mesh.normals = NULL;
+        } else {
+            mesh.vertices = memcpy(RL_MALLOC(sizeof(float) * 3 * vc), mesh.vertices, sizeof(float) * 3 * vc);
+            mesh.texcoords = memcpy(RL_MALLOC(sizeof(float) * 2 * vc), mesh.texcoords, sizeof(float) * 2 * vc);
+            mesh.normals = memcpy(RL_MALLOC(sizeof(float) * 3 * vc), mesh.normals, sizeof(float) * 3 * vc);
+        }
+        model.meshes[i] = mesh;
+        AddMeshStats(&res, &empty, mesh.vertexCount, mesh.triangleCount, am.bounds);
+    }
+
+    res.memory = GetObjMemoryUsage(model);
+    if (stats) *stats = res;
+    return model;
+}
+
+Model LoadObjFromArchive(ObjArchive archive, const char *name, unsigned int flags) {
+    return LoadObjFromArchiveWithStats(archive, name, flags, NULL);
 }
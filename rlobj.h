@@ -16,9 +16,80 @@
 extern "C" {
 #endif
 
+// Options for LoadObjEx, can be combined
+typedef enum {
+    OBJ_LOAD_DEFAULT = 0,
+    OBJ_LOAD_GEN_MIPMAPS = 1,       // Generate mipmaps for all material maps, this is done while decoding them
+    OBJ_LOAD_FREE_CPU_DATA = 2,     // Free vertex data in RAM once it's uploaded, see ObjModelStats for bounds
+    OBJ_LOAD_PARALLEL_IMAGES = 4,   // Decode material maps on worker threads, see the note on LoadObjEx
+} ObjLoadFlags;
+
+// Memory held by a model, in bytes
+typedef struct ObjMemoryUsage {
+    unsigned long long cpuBytes;    // Model, mesh and material arrays in RAM
+    unsigned long long gpuBytes;    // Vertex buffers and textures owned by the model
+} ObjMemoryUsage;
+
+// Statistics collected while loading, these stay valid after OBJ_LOAD_FREE_CPU_DATA
+typedef struct ObjModelStats {
+    BoundingBox bounds;             // Bounds of all meshes, in model space
+    int vertexCount;                // Vertices of all meshes
+    int triangleCount;              // Triangles of all meshes
+    ObjMemoryUsage memory;          // Memory held right after loading
+} ObjModelStats;
+
+// Model whose meshes are drawn with DrawMeshInstanced
+// Every mesh in model is drawn once for each of its transforms
+typedef struct ObjInstancedModel {
+    Model model;                    // Model containing only one mesh per group of identical meshes
+    Matrix **transforms;            // Instance transforms, one array per mesh
+    int *instanceCounts;            // Number of transforms per mesh
+    unsigned long long memorySaved; // Bytes of vertex data not stored, because they were instances
+} ObjInstancedModel;
+
+// Archive of pre-parsed models and their textures, written by ExportObjArchive or the rlobj-pack tool
+typedef struct ObjArchive {
+    unsigned char *data;            // Archive contents, mapped into memory where possible
+    unsigned long long size;        // Size of data in bytes
+    bool mapped;                    // Whether data is a file mapping
+} ObjArchive;
+
 // Naming is important to avoid linker errors
 // raylib has a LoadOBJ
 Model LoadObj(const char *filename);
+// NOTE: OBJ_LOAD_PARALLEL_IMAGES calls LoadImage, LoadImageFromMemory and ImageMipmaps from several threads at once.
+//  raylib 4.0 isn't safe for that, LoadImageFromMemory lowercases the file type in a shared buffer, so maps of
+//  different formats can fail to decode. Only use it with image loaders and callbacks that are thread-safe.
+Model LoadObjEx(const char *filename, unsigned int flags);
+Model LoadObjWithStats(const char *filename, unsigned int flags, ObjModelStats *stats);
+
+// Meant for models loaded by rlobj: vertex buffer sizes follow the vboId layout of UploadMesh in raylib 4.0,
+//  buffers in other slots (e.g. bone buffers of later raylib versions) aren't counted
+ObjMemoryUsage GetObjMemoryUsage(Model model);
+
+// Loads an OBJ and stores meshes that are identical up to a rotation and translation only once
+// NOTE: Meshes are only drawn with DrawMeshInstanced if their material has an instancing shader, like in raylib's
+//  shaders_mesh_instancing example. With the default shader every instance is drawn with DrawMesh.
+ObjInstancedModel LoadObjInstanced(const char *filename, unsigned int flags);
+void DrawObjInstanced(ObjInstancedModel model);
+void UnloadObjInstanced(ObjInstancedModel model);
+
+// Writes all OBJ files with their materials and textures into one archive
+// Models are stored under the names passed here
+bool ExportObjArchive(const char *filename, const char **objFiles, int count);
+ObjArchive LoadObjArchive(const char *filename);
+void UnloadObjArchive(ObjArchive archive);
+// Meshes are uploaded straight from the archive, which has to outlive this call only
+Model LoadObjFromArchive(ObjArchive archive, const char *name, unsigned int flags);
+Model LoadObjFromArchiveWithStats(ObjArchive archive, const char *name, unsigned int flags, ObjModelStats *stats);
+
+// Internals used by the benchmarks in test.c, these aren't part of the API
+#ifdef RLOBJ_BENCHMARK
+#define OBJ_LOAD_GENERAL_FACES 0x80000000u  // Don't use the readers specialized for one face format
+// Loads a model without uploading its meshes, material maps are still uploaded
+Model LoadObjDry(const char *filename, unsigned int flags);
+void UnloadObjDry(Model model);
+#endif
 
 #ifdef __cplusplus
 };
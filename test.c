@@ -2,6 +2,8 @@
 
 #include "rlobj.h"
 #include "stdio.h"
+#include "float.h"
+#include "string.h"
 #include "raymath.h"
 
 typedef struct TwoTimes {
@@ -63,6 +65,160 @@ void Bench() {
     printf("total speedup: %.2f\n", t1 / t2);
 }
 
+// Writes a grid of quads as an OBJ file, with every face in the given edge format
+// Passing NULL as format cycles through all formats to exercise switching between them
+bool WriteFaceFormatObj(const char *filename, const char *format, int size) {
+    const char *formats[] = {"%d", "%d/%d", "%d//%d", "%d/%d/%d"};
+    FILE *file = fopen(filename, "w");
+    if (!file) return false;
+
+    for (int y = 0; y <= size; y++) {
+        for (int x = 0; x <= size; x++) {
+            fprintf(file, "v %d.0 0.0 %d.0\nvt %.4f %.4f\nvn 0.0 1.0 0.0\n", x, y, (float) x / size, (float) y / size);
+        }
+    }
+
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            int i = y * (size + 1) + x + 1;
+            int corners[2][3] = {{i, i + 1, i + size + 2}, {i, i + size + 2, i + size + 1}};
+            for (int t = 0; t < 2; t++) {
+                const char *edge = format ? format : formats[(y * size + x) % 4];
+                fputc('f', file);
+                for (int c = 0; c < 3; c++) {
+                    fputc(' ', file);
+                    fprintf(file, edge, corners[t][c], corners[t][c], corners[t][c]);
+                }
+                fputc('\n', file);
+            }
+        }
+    }
+
+    fclose(file);
+    return true;
+}
+
+// Time to parse a file without uploading anything, in seconds
+double TimeDryLoad(const char *filename, unsigned int flags) {
+    double start = GetTime();
+    Model model = LoadObjDry(filename, flags);
+    double total = GetTime() - start;
+    UnloadObjDry(model);
+    return total;
+}
+
+// Measures parsing throughput per face format, with and without the specialized face readers
+// Both columns include the same attribute expansion, so the difference is only the face parsing
+// Each column is the best of several runs, and the readers take turns going first so neither gets the cold cache
+void BenchFaceFormats() {
+    const char *names[] = {"v", "v/vt", "v//vn", "v/vt/vn", "mixed"};
+    const char *formats[] = {"%d", "%d/%d", "%d//%d", "%d/%d/%d", NULL};
+    const char *filename = "face_format_bench.obj";
+    const int size = 300; // 180000 triangles
+    const int runs = 6;
+
+    printf("| %10s | %12s | %16s | %11s | %8s |\n", "format", "general (ms)", "specialized (ms)", "MB/s", "speedup");
+
+    for (int i = 0; i < 5; i++) {
+        if (!WriteFaceFormatObj(filename, formats[i], size)) {
+            printf("can't write %s, skipping face format benchmark\n", filename);
+            return;
+        }
+
+        FILE *file = fopen(filename, "r");
+        if (!file) break;
+        fseek(file, 0, SEEK_END);
+        double megabytes = (double) ftell(file) / (1024 * 1024);
+        fclose(file);
+
+        unsigned int modes[2] = {OBJ_LOAD_GENERAL_FACES, OBJ_LOAD_DEFAULT};
+        double best[2] = {DBL_MAX, DBL_MAX};
+        for (int run = 0; run < runs; run++) {
+            for (int j = 0; j < 2; j++) {
+                int mode = (run + j) % 2;
+                double time = TimeDryLoad(filename, modes[mode]);
+                if (time < best[mode]) best[mode] = time;
+            }
+        }
+        double general = best[0], specialized = best[1];
+
+        printf("| %10s | %12.2f | %16.2f | %11.2f | %8.2f |\n", names[i], general * 1000, specialized * 1000,
+               megabytes / specialized, general / specialized);
+    }
+
+    remove(filename);
+    putchar('\n');
+}
+
+// Compares two models loaded from the same OBJ, GPU handles aren't compared
+bool SameModel(Model a, Model b) {
+    if (a.meshCount != b.meshCount || a.materialCount != b.materialCount) return false;
+
+    for (int i = 0; i < a.meshCount; i++) {
+        Mesh ma = a.meshes[i], mb = b.meshes[i];
+        if (ma.vertexCount != mb.vertexCount || ma.triangleCount != mb.triangleCount) return false;
+        if (a.meshMaterial[i] != b.meshMaterial[i]) return false;
+        if (ma.vertexCount == 0) continue;
+
+        size_t count = (size_t) ma.vertexCount;
+        if (memcmp(ma.vertices, mb.vertices, sizeof(float) * 3 * count) != 0 ||
+            memcmp(ma.texcoords, mb.texcoords, sizeof(float) * 2 * count) != 0 ||
+            memcmp(ma.normals, mb.normals, sizeof(float) * 3 * count) != 0)
+            return false;
+    }
+
+    for (int i = 0; i < a.materialCount; i++) {
+        for (int j = 0; j < MAX_MATERIAL_MAPS; j++) {
+            MaterialMap ma = a.materials[i].maps[j], mb = b.materials[i].maps[j];
+            if (ma.texture.width != mb.texture.width || ma.texture.height != mb.texture.height ||
+                memcmp(&ma.color, &mb.color, sizeof(Color)) != 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Packs the example models into an archive and checks that loading them back gives the same models as LoadObj
+void CheckArchiveRoundTrip() {
+    const char *models[] = {
+        "raylib/examples/models/resources/models/bridge.obj",
+        "raylib/examples/models/resources/models/castle.obj",
+        "raylib/examples/models/resources/models/cube.obj",
+        "raylib/examples/models/resources/models/house.obj",
+        "raylib/examples/models/resources/models/market.obj",
+        "raylib/examples/models/resources/models/turret.obj",
+        "raylib/examples/models/resources/models/well.obj",
+        "raylib/examples/shaders/resources/models/barracks.obj",
+        "raylib/examples/shaders/resources/models/church.obj",
+    };
+    const int count = sizeof(models) / sizeof(models[0]);
+    const char *filename = "round_trip.rlpk";
+
+    if (!ExportObjArchive(filename, models, count)) {
+        printf("can't write %s, skipping archive round trip\n", filename);
+        return;
+    }
+
+    ObjArchive archive = LoadObjArchive(filename);
+    int matching = 0;
+
+    for (int i = 0; i < count; i++) {
+        Model expected = LoadObj(models[i]);
+        Model packed = LoadObjFromArchive(archive, models[i], OBJ_LOAD_DEFAULT);
+
+        if (SameModel(expected, packed)) matching++;
+        else printf("%s differs after an archive round trip\n", models[i]);
+
+        UnloadModel(expected);
+        UnloadModel(packed);
+    }
+
+    UnloadObjArchive(archive);
+    remove(filename);
+
+    printf("archive round trip: %i of %i models match\n\n", matching, count);
+}
+
 int main(void) {
     // Initialization
     //--------------------------------------------------------------------------------------
@@ -84,6 +240,8 @@ int main(void) {
     camera.projection = CAMERA_PERSPECTIVE;
 
     Bench();
+    BenchFaceFormats();
+    CheckArchiveRoundTrip();
 
     Model model = LoadObj("raylib/examples/models/resources/models/castle.obj");
 